@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+#include "bench_fixtures.hpp"
+#include "BVHNode.hpp"
+#include "SphereSet.hpp"
+
+static void BM_BVHNode_Build(benchmark::State &state)
+{
+    std::vector<SceneObject *> triangles = BenchFixtures::randomTriangles(state.range(0), 4.0);
+
+    for (auto _ : state)
+    {
+        // build() reorders its input, start every iteration from the same order
+        state.PauseTiming();
+        std::vector<SceneObject *> objects(triangles);
+        ObjectPool<BVHNode> *nodes = new ObjectPool<BVHNode>();
+        PrimitiveArrays arrays;
+        state.ResumeTiming();
+
+        BVHNode *root = nodes->create();
+        root->build(objects, *nodes, arrays);
+        benchmark::DoNotOptimize(root);
+
+        state.PauseTiming();
+        delete nodes;
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    BenchFixtures::deleteObjects(triangles);
+}
+BENCHMARK(BM_BVHNode_Build)->RangeMultiplier(8)->Range(512, 32768)->Unit(benchmark::kMillisecond);
+
+static void BM_BVHNode_Traverse(benchmark::State &state, bool coherent)
+{
+    std::vector<SceneObject *> triangles = BenchFixtures::randomTriangles(state.range(0), 4.0);
+    std::vector<SceneObject *> objects(triangles);
+    ObjectPool<BVHNode> nodes;
+    PrimitiveArrays arrays;
+    BVHNode root;
+    root.build(objects, nodes, arrays);
+
+    std::vector<Ray> rays = coherent ? BenchFixtures::coherentRays(128, 72)
+                                     : BenchFixtures::incoherentRays(128 * 72, 4.0);
+
+    for (auto _ : state)
+    {
+        int hits = 0;
+        for (Ray &ray : rays)
+        {
+            HitRecord closest;
+            hits += root.findClosestIntersection(ray, closest, CULLING_BOTH);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * rays.size());
+    state.counters["rays/s"] = benchmark::Counter(state.iterations() * rays.size(), benchmark::Counter::kIsRate);
+    BenchFixtures::deleteObjects(triangles);
+}
+BENCHMARK_CAPTURE(BM_BVHNode_Traverse, coherent, true)->RangeMultiplier(8)->Range(512, 32768);
+BENCHMARK_CAPTURE(BM_BVHNode_Traverse, incoherent, false)->RangeMultiplier(8)->Range(512, 32768);
+
+// The same random spheres as separate objects in a BVH, and as one SoA sphere set
+static void BM_Spheres_BVHNode(benchmark::State &state)
+{
+    std::vector<SceneObject *> spheres = BenchFixtures::randomSpheres(state.range(0), 4.0);
+    std::vector<SceneObject *> objects(spheres);
+    ObjectPool<BVHNode> nodes;
+    PrimitiveArrays arrays;
+    BVHNode root;
+    root.build(objects, nodes, arrays);
+
+    std::vector<Ray> rays = BenchFixtures::incoherentRays(128 * 72, 4.0);
+    for (auto _ : state)
+    {
+        int hits = 0;
+        for (Ray &ray : rays)
+        {
+            HitRecord closest;
+            hits += root.findClosestIntersection(ray, closest, CULLING_BOTH);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.counters["rays/s"] = benchmark::Counter(state.iterations() * rays.size(), benchmark::Counter::kIsRate);
+    BenchFixtures::deleteObjects(spheres);
+}
+BENCHMARK(BM_Spheres_BVHNode)->RangeMultiplier(8)->Range(512, 262144);
+
+static void BM_Spheres_SphereSet(benchmark::State &state)
+{
+    std::vector<SceneObject *> spheres = BenchFixtures::randomSpheres(state.range(0), 4.0);
+    SphereSet set;
+    for (SceneObject *sphere : spheres)
+    {
+        const AABB &box = sphere->boundingBox;
+        set.addSphere((box.getMin() + box.getMax()) * 0.5, (box.getMax().x - box.getMin().x) * 0.5);
+    }
+    set.applyTransform();
+    set.calculateBoundingBox();
+
+    std::vector<Ray> rays = BenchFixtures::incoherentRays(128 * 72, 4.0);
+    for (auto _ : state)
+    {
+        int hits = 0;
+        for (Ray &ray : rays)
+        {
+            HitRecord closest;
+            hits += set.intersects(ray, closest, CULLING_BOTH);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.counters["rays/s"] = benchmark::Counter(state.iterations() * rays.size(), benchmark::Counter::kIsRate);
+    BenchFixtures::deleteObjects(spheres);
+}
+BENCHMARK(BM_Spheres_SphereSet)->RangeMultiplier(8)->Range(512, 262144);
@@ -0,0 +1,110 @@
+#include "bench_fixtures.hpp"
+#include "Sphere.hpp"
+#include "Triangle.hpp"
+
+namespace BenchFixtures
+{
+    std::vector<Ray> coherentRays(int width, int height)
+    {
+        std::vector<Ray> rays;
+        rays.reserve(width * height);
+
+        Vector3 origin(0, 0, -1);
+        double halfHeight = 0.5 * height / width;
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                Vector3 dir(-0.5 + (x + 0.5) / width, halfHeight - (y + 0.5) / width, 1);
+                rays.push_back(Ray(origin, dir));
+            }
+        }
+        return rays;
+    }
+
+    std::vector<Ray> incoherentRays(size_t count, double extent, unsigned int seed)
+    {
+        std::vector<Vector3> origins = randomVectors(count, extent, seed);
+        std::vector<Vector3> directions = randomVectors(count, 1.0, seed + 1);
+
+        std::vector<Ray> rays;
+        rays.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            // Shift the origin in front of the scattered primitives (z >= 5)
+            Vector3 origin = origins[i] + Vector3(0, 0, 5 + extent);
+            rays.push_back(Ray(origin, directions[i]));
+        }
+        return rays;
+    }
+
+    std::vector<Vector3> randomVectors(size_t count, double extent, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> dist(-extent, extent);
+
+        std::vector<Vector3> vectors;
+        vectors.reserve(count);
+        while (vectors.size() < count)
+        {
+            Vector3 v(dist(rng), dist(rng), dist(rng));
+            // Avoid degenerate zero directions
+            if (v.lengthSquared() > 1e-6 * extent * extent)
+            {
+                vectors.push_back(v);
+            }
+        }
+        return vectors;
+    }
+
+    std::vector<SceneObject *> randomSpheres(size_t count, double extent, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> pos(-extent, extent);
+        std::uniform_real_distribution<double> radius(0.05, 0.3);
+
+        std::vector<SceneObject *> objects;
+        objects.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            Sphere *sphere = new Sphere(radius(rng));
+            sphere->transform.setPosition(Vector3(pos(rng), pos(rng), 5 + extent + pos(rng)));
+            sphere->applyTransform();
+            sphere->calculateBoundingBox();
+            objects.push_back(sphere);
+        }
+        return objects;
+    }
+
+    std::vector<SceneObject *> randomTriangles(size_t count, double extent, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> pos(-extent, extent);
+        std::uniform_real_distribution<double> corner(-0.3, 0.3);
+
+        std::vector<SceneObject *> objects;
+        objects.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            Vector3 center(pos(rng), pos(rng), 5 + extent + pos(rng));
+            Vector3 a = center + Vector3(corner(rng), corner(rng), corner(rng));
+            Vector3 b = center + Vector3(corner(rng), corner(rng), corner(rng));
+            Vector3 c = center + Vector3(corner(rng), corner(rng), corner(rng));
+
+            Triangle *triangle = new Triangle(a, b, c);
+            triangle->applyTransform();
+            triangle->calculateBoundingBox();
+            objects.push_back(triangle);
+        }
+        return objects;
+    }
+
+    void deleteObjects(std::vector<SceneObject *> &objects)
+    {
+        for (SceneObject *object : objects)
+        {
+            delete object;
+        }
+        objects.clear();
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <random>
+#include <vector>
+#include "Vector3.hpp"
+#include "Ray.hpp"
+#include "SceneObject.hpp"
+
+/**
+ * Synthetic inputs shared by the benchmarks. Every generator takes a seed so
+ * that two runs time exactly the same work.
+ */
+namespace BenchFixtures
+{
+    const unsigned int Seed = 1234;
+
+    /**
+     * Primary rays of a width x height pinhole camera at the origin looking
+     * down +z: neighbouring rays have almost the same direction.
+     */
+    std::vector<Ray> coherentRays(int width, int height);
+
+    /**
+     * Rays with random origins in [-extent, extent]^3 and random directions.
+     */
+    std::vector<Ray> incoherentRays(size_t count, double extent, unsigned int seed = Seed);
+
+    std::vector<Vector3> randomVectors(size_t count, double extent, unsigned int seed = Seed);
+
+    /**
+     * Spheres / small triangles scattered in [-extent, extent]^2 x [5, 5 + 2 extent],
+     * transformed and with their bounding box computed, ready to intersect.
+     * The caller owns the objects (see deleteObjects).
+     */
+    std::vector<SceneObject *> randomSpheres(size_t count, double extent, unsigned int seed = Seed);
+    std::vector<SceneObject *> randomTriangles(size_t count, double extent, unsigned int seed = Seed);
+
+    void deleteObjects(std::vector<SceneObject *> &objects);
+}
@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+#include "bench_fixtures.hpp"
+
+/**
+ * Every ray against every primitive of a small set, without any culling by
+ * bounding box: times the raw intersection kernels.
+ */
+static void runPrimitiveBenchmark(benchmark::State &state, std::vector<SceneObject *> &objects, std::vector<Ray> &rays)
+{
+    HitRecord hit;
+    for (auto _ : state)
+    {
+        int hits = 0;
+        for (Ray &ray : rays)
+        {
+            for (SceneObject *object : objects)
+            {
+                hits += object->intersects(ray, hit, CULLING_BOTH);
+            }
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+
+    int64_t tests = state.iterations() * rays.size() * objects.size();
+    state.SetItemsProcessed(tests);
+    state.counters["rays/s"] = benchmark::Counter(state.iterations() * rays.size(), benchmark::Counter::kIsRate);
+}
+
+static void BM_Sphere_Intersects(benchmark::State &state, bool coherent)
+{
+    std::vector<SceneObject *> spheres = BenchFixtures::randomSpheres(16, 1.0);
+    std::vector<Ray> rays = coherent ? BenchFixtures::coherentRays(64, 36)
+                                     : BenchFixtures::incoherentRays(64 * 36, 1.0);
+
+    runPrimitiveBenchmark(state, spheres, rays);
+    BenchFixtures::deleteObjects(spheres);
+}
+BENCHMARK_CAPTURE(BM_Sphere_Intersects, coherent, true);
+BENCHMARK_CAPTURE(BM_Sphere_Intersects, incoherent, false);
+
+static void BM_Triangle_Intersects(benchmark::State &state, bool coherent)
+{
+    std::vector<SceneObject *> triangles = BenchFixtures::randomTriangles(16, 1.0);
+    std::vector<Ray> rays = coherent ? BenchFixtures::coherentRays(64, 36)
+                                     : BenchFixtures::incoherentRays(64 * 36, 1.0);
+
+    runPrimitiveBenchmark(state, triangles, rays);
+    BenchFixtures::deleteObjects(triangles);
+}
+BENCHMARK_CAPTURE(BM_Triangle_Intersects, coherent, true);
+BENCHMARK_CAPTURE(BM_Triangle_Intersects, incoherent, false);
@@ -0,0 +1,33 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+/**
+ * Same as benchmark_main, but every benchmark is repeated and only the
+ * mean / median / stddev are reported, so that a single noisy run does not
+ * decide whether an optimisation helped. Flags given on the command line
+ * come after the defaults and override them.
+ */
+int main(int argc, char **argv)
+{
+    char repetitions[] = "--benchmark_repetitions=5";
+    char aggregates[] = "--benchmark_report_aggregates_only=true";
+
+    std::vector<char *> args;
+    args.push_back(argv[0]);
+    args.push_back(repetitions);
+    args.push_back(aggregates);
+    for (int i = 1; i < argc; ++i)
+    {
+        args.push_back(argv[i]);
+    }
+
+    int count = (int)args.size();
+    benchmark::Initialize(&count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(count, args.data()))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include <benchmark/benchmark.h>
+#include "bench_fixtures.hpp"
+#include "Color.hpp"
+#include "AABB.hpp"
+
+static const size_t VectorCount = 4096;
+
+static void BM_Vector3_AddScale(benchmark::State &state)
+{
+    std::vector<Vector3> a = BenchFixtures::randomVectors(VectorCount, 10.0);
+    std::vector<Vector3> b = BenchFixtures::randomVectors(VectorCount, 10.0, BenchFixtures::Seed + 1);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < VectorCount; ++i)
+        {
+            Vector3 v = a[i] + (b[i] * 0.5);
+            benchmark::DoNotOptimize(v);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * VectorCount);
+}
+BENCHMARK(BM_Vector3_AddScale);
+
+static void BM_Vector3_Dot(benchmark::State &state)
+{
+    std::vector<Vector3> a = BenchFixtures::randomVectors(VectorCount, 10.0);
+    std::vector<Vector3> b = BenchFixtures::randomVectors(VectorCount, 10.0, BenchFixtures::Seed + 1);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < VectorCount; ++i)
+        {
+            double d = a[i].dot(b[i]);
+            benchmark::DoNotOptimize(d);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * VectorCount);
+}
+BENCHMARK(BM_Vector3_Dot);
+
+static void BM_Vector3_Cross(benchmark::State &state)
+{
+    std::vector<Vector3> a = BenchFixtures::randomVectors(VectorCount, 10.0);
+    std::vector<Vector3> b = BenchFixtures::randomVectors(VectorCount, 10.0, BenchFixtures::Seed + 1);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < VectorCount; ++i)
+        {
+            Vector3 v = a[i].cross(b[i]);
+            benchmark::DoNotOptimize(v);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * VectorCount);
+}
+BENCHMARK(BM_Vector3_Cross);
+
+static void BM_Vector3_Normalize(benchmark::State &state)
+{
+    std::vector<Vector3> a = BenchFixtures::randomVectors(VectorCount, 10.0);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < VectorCount; ++i)
+        {
+            Vector3 v = a[i].normalize();
+            benchmark::DoNotOptimize(v);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * VectorCount);
+}
+BENCHMARK(BM_Vector3_Normalize);
+
+static void BM_Vector3_Reflect(benchmark::State &state)
+{
+    std::vector<Vector3> a = BenchFixtures::randomVectors(VectorCount, 1.0);
+    std::vector<Vector3> normals = BenchFixtures::randomVectors(VectorCount, 1.0, BenchFixtures::Seed + 1);
+    for (Vector3 &n : normals)
+    {
+        n = n.normalize();
+    }
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < VectorCount; ++i)
+        {
+            Vector3 v = a[i].reflect(normals[i]);
+            benchmark::DoNotOptimize(v);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * VectorCount);
+}
+BENCHMARK(BM_Vector3_Reflect);
+
+static void BM_Color_MultiplyAdd(benchmark::State &state)
+{
+    std::vector<Vector3> values = BenchFixtures::randomVectors(VectorCount, 1.0);
+    std::vector<Color> colors;
+    for (const Vector3 &v : values)
+    {
+        colors.push_back(Color(std::abs(v.x), std::abs(v.y), std::abs(v.z)));
+    }
+
+    for (auto _ : state)
+    {
+        Color sum;
+        for (size_t i = 1; i < VectorCount; ++i)
+        {
+            sum = sum + (colors[i] * colors[i - 1]) * 0.5f;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (VectorCount - 1));
+}
+BENCHMARK(BM_Color_MultiplyAdd);
+
+/**
+ * Slab test of one box against coherent (camera) or incoherent (random) rays.
+ */
+static void BM_AABB_Intersects(benchmark::State &state, bool coherent)
+{
+    std::vector<Ray> rays = coherent ? BenchFixtures::coherentRays(128, 72)
+                                     : BenchFixtures::incoherentRays(128 * 72, 4.0);
+    AABB box(Vector3(-1, -1, 4), Vector3(1, 1, 6));
+
+    for (auto _ : state)
+    {
+        int hits = 0;
+        for (Ray &ray : rays)
+        {
+            hits += box.intersects(ray);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * rays.size());
+    state.counters["rays/s"] = benchmark::Counter(state.iterations() * rays.size(), benchmark::Counter::kIsRate);
+}
+BENCHMARK_CAPTURE(BM_AABB_Intersects, coherent, true);
+BENCHMARK_CAPTURE(BM_AABB_Intersects, incoherent, false);